@@ -55,4 +55,31 @@ for N in unique_N:
     plt.savefig(f'plots/efficiency_N{N}.png', bbox_inches='tight')
     plt.close()
 
+# Costo de nacimientos y muertes vs tasa de renovacion
+if os.path.exists('results_turnover.csv'):
+    tdf = pd.read_csv('results_turnover.csv')
+    turn = tdf.groupby(['binary','n_threads','N','turnover']).agg(
+        mean_time_update=('time_update', 'mean'),
+        mean_time_spawn=('time_spawn', 'mean'),
+        mean_time_kill=('time_kill', 'mean'),
+        mean_spawned=('spawned', 'mean'),
+        mean_killed=('killed', 'mean'),
+        reps=('time_update','count')
+    ).reset_index()
+    turn.to_csv('turnover_summary.csv', index=False)
+    print("Saved turnover_summary.csv")
+
+    for col, label in [('mean_time_spawn', 'Tiempo de nacimientos (s)'), ('mean_time_kill', 'Tiempo de compactación (s)')]:
+        plt.figure()
+        for (binary, threads), sub in turn.groupby(['binary','n_threads']):
+            sub = sub.sort_values('turnover')
+            plt.plot(sub['turnover'], sub[col], marker='o', linestyle='-', label=f'{binary} T={threads}')
+        plt.xlabel('Renovación (fracción de la población por segundo)')
+        plt.ylabel(label)
+        plt.title(f'{label} vs renovación (N={turn["N"].iloc[0]})')
+        plt.legend()
+        plt.grid(True)
+        plt.savefig(f'plots/{col}_vs_turnover.png', bbox_inches='tight')
+        plt.close()
+
 print("Plots saved in ./plots/")
@@ -39,4 +39,33 @@ for T in "${THREADS[@]}"; do
   done
 done
 
-echo "DONE. raw results in $OUT"
+# Costo de nacimientos y muertes segun la tasa de renovacion
+TURNOVERS=(0 0.1 0.5 1 2 5)
+TURN_N=2000
+TURN_OUT=results_turnover.csv
+echo "binary,n_threads,N,turnover,rep,frames,time_update,time_spawn,time_kill,spawned,killed" > $TURN_OUT
+
+parse_turnover() {
+  local line="$1"
+  for key in TIME_UPDATE TIME_SPAWN TIME_KILL SPAWNED KILLED; do
+    printf ",%s" "$(echo "$line" | grep "^$key " | awk '{print $2}')"
+  done
+}
+
+for R in "${TURNOVERS[@]}"; do
+  for ((r=1; r<=REPEATS; r++)); do
+    echo "Running SEQ turnover=$R rep=$r"
+    line=$($SEQ_BIN $TURN_N 800 600 $FRAMES $R)
+    echo "screensaver_seq,1,$TURN_N,$R,$r,$FRAMES$(parse_turnover "$line")" >> $TURN_OUT
+  done
+  for T in "${THREADS[@]}"; do
+    export OMP_NUM_THREADS=$T
+    for ((r=1; r<=REPEATS; r++)); do
+      echo "Running PAR T=$T turnover=$R rep=$r"
+      line=$($PAR_BIN $TURN_N 800 600 $T 60 $FRAMES $R)
+      echo "screensaver_par,$T,$TURN_N,$R,$r,$FRAMES$(parse_turnover "$line")" >> $TURN_OUT
+    done
+  done
+done
+
+echo "DONE. raw results in $OUT and $TURN_OUT"
@@ -0,0 +1,120 @@
+// Benchmark sin SDL del pool de partículas: mide el costo de nacimientos
+// (emisor continuo) y muertes (compactación) según la tasa de renovación.
+// Usa el mismo Particle, initParticle y emitParticles que los screensavers.
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <limits>
+#include <stdio.h>
+#include <stdlib.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+#include "timing_helpers.h"
+#include "particle.h"
+
+// Resultado de una corrida por paso de simulación
+struct Sample {
+    double spawn_us;   // Tiempo de nacimientos por paso (us)
+    double kill_us;    // Tiempo de compactación por paso (us)
+    double spawned;    // Partículas nacidas por paso
+    double killed;     // Partículas muertas por paso
+};
+
+static Sample runOnce(int N, float turnover, int steps, unsigned long seed) {
+    const double dt = 1.0 / 60.0;
+    const int width = 800, height = 600;
+    std::mt19937_64 rng(seed);
+    std::uniform_real_distribution<float> ux(0.0f, (float)width);
+    std::uniform_real_distribution<float> uy(0.0f, (float)height);
+    std::uniform_real_distribution<float> uv(-120.0f, 120.0f);
+    std::uniform_real_distribution<float> ul0(0.0f, 2.0f);
+
+    // Misma capacidad e inicialización que los screensavers
+    ParticlePool<Particle> pool((size_t)N * 2 + BURST_SIZE * 8);
+    unsigned long born = 0;
+    for (int i = 0; i < N; i++) {
+        float life = turnover > 0.0f ? ul0(rng) / turnover : std::numeric_limits<float>::infinity();
+        initParticle(*pool.spawn(), ux(rng), uy(rng), uv(rng) * 0.01f, uv(rng) * 0.01f, life, rng, born++);
+    }
+    auto isDead = [](const Particle& p) { return p.life <= 0.0f; };
+
+    // Calentamiento: dos vidas medias para llegar al régimen estacionario
+    int warmup = turnover > 0.0f ? (int)(2.0 / turnover / dt) : 0;
+    double emit_acc = 0.0;
+    Sample s = { 0.0, 0.0, 0.0, 0.0 };
+
+    for (int step = 0; step < warmup + steps; step++) {
+        bool measure = step >= warmup;
+
+        double spawn_s = now_seconds();
+        int spawned = emitParticles(pool, N, width, height, turnover, dt, emit_acc, false, 0, 0, rng, born);
+        double spawn_e = now_seconds();
+
+        int deaths = 0;
+#ifdef _OPENMP
+        #pragma omp parallel for schedule(static) reduction(+:deaths)
+#endif
+        for (size_t i = 0; i < pool.size(); i++) {
+            pool[i].life -= dt;
+            if (pool[i].life <= 0.0f) deaths++;
+        }
+
+        double kill_s = now_seconds();
+        size_t killed = deaths > 0 ? pool.compact(isDead) : 0;
+        double kill_e = now_seconds();
+
+        if (measure) {
+            s.spawn_us += (spawn_e - spawn_s) * 1e6;
+            s.kill_us += (kill_e - kill_s) * 1e6;
+            s.spawned += spawned;
+            s.killed += killed;
+        }
+    }
+    s.spawn_us /= steps; s.kill_us /= steps;
+    s.spawned /= steps; s.killed /= steps;
+    return s;
+}
+
+static double median(std::vector<double> v) {
+    std::sort(v.begin(), v.end());
+    size_t n = v.size();
+    return n % 2 ? v[n / 2] : 0.5 * (v[n / 2 - 1] + v[n / 2]);
+}
+
+int main(int argc, char** argv) {
+    int N = 2000;
+    int threads = 1;
+    int steps = 600;
+    int repeats = 10;
+    if (argc > 1) N = atoi(argv[1]);
+    if (argc > 2) threads = atoi(argv[2]);
+    if (argc > 3) steps = atoi(argv[3]);
+    if (argc > 4) repeats = atoi(argv[4]);
+    if (N < 1) N = 1;
+    if (threads < 1) threads = 1;
+    if (steps < 1) steps = 1;
+    if (repeats < 1) repeats = 1;
+#ifdef _OPENMP
+    omp_set_num_threads(threads);
+#else
+    threads = 1;
+#endif
+
+    const float turnovers[] = { 0.0f, 0.1f, 0.5f, 1.0f, 2.0f, 5.0f };
+    printf("n_threads,N,turnover,spawned_per_step,killed_per_step,spawn_us_per_step,kill_us_per_step\n");
+    for (float tr : turnovers) {
+        std::vector<double> spawn_us, kill_us, spawned, killed;
+        for (int r = 0; r < repeats; r++) {
+            Sample s = runOnce(N, tr, steps, 1234 + r);
+            spawn_us.push_back(s.spawn_us);
+            kill_us.push_back(s.kill_us);
+            spawned.push_back(s.spawned);
+            killed.push_back(s.killed);
+        }
+        // Mediana entre repeticiones para filtrar ruido del sistema
+        printf("%d,%d,%.1f,%.2f,%.2f,%.3f,%.3f\n", threads, N, tr,
+               median(spawned), median(killed), median(spawn_us), median(kill_us));
+    }
+    return 0;
+}
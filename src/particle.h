@@ -0,0 +1,73 @@
+#pragma once
+#include <random>
+#include <cmath>
+#include <algorithm>
+#include "particle_pool.h"
+
+// Estructura de una partícula (sin dependencias de SDL para poder medirla aparte)
+struct Particle {
+    float x, y;                     // Posición
+    float vx, vy;                   // Velocidad
+    float ax, ay;                   // Aceleración
+    int r;                          // Radio
+    unsigned char cr, cg, cb;       // Color RGB
+    unsigned char alpha;            // Opacidad
+    float hue;                      // Fase inicial del gradiente de color
+    float life;                     // Tiempo de vida restante (s)
+    float fade;                     // Ventana de desvanecimiento antes de morir (s)
+};
+
+const int BURST_SIZE = 64;        // Partículas emitidas por clic
+const float BURST_LIFE = 3.0f;    // Vida media de las partículas de ráfaga (s)
+const float FADE_TIME = 0.5f;     // Desvanecimiento máximo antes de morir (s)
+const float FADE_FRACTION = 0.25f; // Fracción máxima de la vida que se pasa desvaneciendo
+
+// Inicializa una partícula recién nacida en (x, y) con una vida dada
+inline void initParticle(Particle& p, float x, float y, float vx, float vy, float life, std::mt19937_64& rng, unsigned long born) {
+    std::uniform_int_distribution<int> ur(3, 20);
+    std::uniform_int_distribution<int> uc(0, 255);
+    p.r = ur(rng);
+    p.x = x; p.y = y;
+    p.vx = vx; p.vy = vy;
+    p.ax = p.ay = 0.0f;
+    p.cr = uc(rng); p.cg = uc(rng); p.cb = uc(rng);
+    p.alpha = 160 + uc(rng) % 96;
+    p.hue = (born % 50) * 0.02f;  // Módulo en entero: born no pierde precisión al crecer
+    p.life = life;
+    // Las vidas cortas (renovación alta) se desvanecen solo al final, no toda la vida
+    p.fade = std::min(FADE_TIME, life * FADE_FRACTION);
+}
+
+// Emisores: flujo continuo que repone la población (N * turnover por segundo)
+// y ráfaga en el clic. Solo escribe en espacios ya reservados del pool; si
+// está lleno, descarta. Devuelve cuántas partículas nacieron.
+inline int emitParticles(ParticlePool<Particle>& pool, int N, int width, int height, float turnover, double dt,
+                         double& emit_acc, bool burst, int bx, int by, std::mt19937_64& rng, unsigned long& born) {
+    std::uniform_real_distribution<float> ux(0.0f, (float)width);
+    std::uniform_real_distribution<float> uy(0.0f, (float)height);
+    std::uniform_real_distribution<float> uv(-120.0f, 120.0f);
+    std::uniform_real_distribution<float> ul(0.5f, 1.5f);
+    int spawned = 0;
+
+    if (turnover > 0.0f) {
+        emit_acc += N * turnover * dt;
+        int k = (int)emit_acc;
+        emit_acc -= k;
+        for (int j = 0; j < k; j++) {
+            Particle* p = pool.spawn();
+            if (!p) break;
+            initParticle(*p, ux(rng), uy(rng), uv(rng) * 0.01f, uv(rng) * 0.01f, ul(rng) / turnover, rng, born++);
+            spawned++;
+        }
+    }
+
+    if (burst) {
+        for (int j = 0; j < BURST_SIZE; j++) {
+            Particle* p = pool.spawn();
+            if (!p) break;
+            initParticle(*p, (float)bx, (float)by, uv(rng) * 0.03f, uv(rng) * 0.03f, ul(rng) * BURST_LIFE, rng, born++);
+            spawned++;
+        }
+    }
+    return spawned;
+}
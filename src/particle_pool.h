@@ -0,0 +1,110 @@
+#pragma once
+#include <vector>
+#include <algorithm>
+#include <cstddef>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// Almacén de partículas con capacidad fija.
+// Toda la memoria se reserva al crear el pool, así que nacer o morir
+// dentro del bucle de frames nunca asigna memoria. Las partículas vivas
+// ocupan siempre el rango contiguo [0, size()), por lo que los bucles
+// paralelos pueden seguir recorriéndolas por índice.
+template <typename T>
+class ParticlePool {
+public:
+    // Por debajo de este tamaño la compactación secuencial (~2 ns por
+    // partícula) es más barata que abrir una región paralela
+    static const size_t PARALLEL_COMPACT_MIN = 16384;
+
+    explicit ParticlePool(size_t capacity)
+        : items_(capacity), count_(0) {
+#ifdef _OPENMP
+        scratch_.resize(capacity);
+        offsets_.resize(omp_get_max_threads() + 1);
+#endif
+    }
+
+    size_t size() const { return count_; }
+    size_t capacity() const { return items_.size(); }
+    bool full() const { return count_ == items_.size(); }
+
+    T& operator[](size_t i) { return items_[i]; }
+    const T& operator[](size_t i) const { return items_[i]; }
+
+    // Reserva el siguiente espacio libre; devuelve nullptr si el pool está lleno
+    T* spawn() {
+        if (full()) return nullptr;
+        return &items_[count_++];
+    }
+
+    // Elimina las partículas para las que dead(p) es verdadero, conservando
+    // el orden de las sobrevivientes. Devuelve cuántas se eliminaron.
+    template <typename Pred>
+    size_t compact(Pred dead) {
+        size_t before = count_;
+#ifdef _OPENMP
+        if (before >= PARALLEL_COMPACT_MIN) {
+            compactParallel(dead);
+            return before - count_;
+        }
+#endif
+        // Compactación secuencial en el mismo arreglo
+        size_t out = 0;
+        for (size_t i = 0; i < before; i++) {
+            if (dead(items_[i])) continue;
+            if (out != i) items_[out] = items_[i];
+            out++;
+        }
+        count_ = out;
+        return before - count_;
+    }
+
+private:
+#ifdef _OPENMP
+    template <typename Pred>
+    void compactParallel(Pred dead) {
+        size_t before = count_;
+        // Compactación paralela: cada hilo cuenta sus sobrevivientes, se hace
+        // un prefijo exclusivo y cada hilo copia a su rango en el buffer auxiliar.
+        // El equipo se limita al tamaño de offsets_ por si el número de hilos
+        // creció después de crear el pool.
+        size_t total = 0;
+        int max_threads = std::min(omp_get_max_threads(), (int)offsets_.size() - 1);
+        #pragma omp parallel num_threads(max_threads)
+        {
+            int tid = omp_get_thread_num();
+            int nt = omp_get_num_threads();
+            size_t begin = before * tid / nt;
+            size_t end = before * (tid + 1) / nt;
+
+            size_t alive = 0;
+            for (size_t i = begin; i < end; i++)
+                if (!dead(items_[i])) alive++;
+            offsets_[tid + 1] = alive;
+
+            #pragma omp barrier
+            #pragma omp single
+            {
+                offsets_[0] = 0;
+                for (int t = 1; t <= nt; t++) offsets_[t] += offsets_[t - 1];
+                total = offsets_[nt];
+            }
+
+            size_t out = offsets_[tid];
+            for (size_t i = begin; i < end; i++)
+                if (!dead(items_[i])) scratch_[out++] = items_[i];
+        }
+        items_.swap(scratch_);
+        count_ = total;
+    }
+#endif
+
+    std::vector<T> items_;
+    size_t count_;
+#ifdef _OPENMP
+    std::vector<T> scratch_;       // Destino de la compactación paralela
+    std::vector<size_t> offsets_;  // Prefijo de sobrevivientes por hilo
+#endif
+};
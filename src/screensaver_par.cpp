@@ -6,20 +6,13 @@
 #include <iostream>
 #include <stdexcept>
 #include <unordered_map>
+#include <limits>
+#include <algorithm>
 #include <omp.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include "timing_helpers.h"
-
-// Estructura de una partícula
-struct Particle {
-    float x, y;           // Posición
-    float vx, vy;         // Velocidad
-    float ax, ay;         // Aceleración
-    int r;                // Radio
-    Uint8 cr, cg, cb;     // Color RGB
-    Uint8 alpha;          // Opacidad
-};
+#include "particle.h"
 
 // Configuración del programa
 struct Config {
@@ -28,6 +21,7 @@ struct Config {
     int height = 600; // Alto de ventana
     int threads = 4;  // Hilos para OpenMP
     int fps = 60;     // Cuadros por segundo
+    float turnover = 0.0f; // Fracción de la población renovada por segundo
 };
 
 // Parseo de argumentos desde terminal
@@ -38,10 +32,12 @@ static Config parseArgs(int argc, char** argv) {
     if (argc > 3) cfg.height = std::stoi(argv[3]);
     if (argc > 4) cfg.threads = std::stoi(argv[4]);
     if (argc > 5) cfg.fps = std::stoi(argv[5]);
+    if (argc > 7) cfg.turnover = std::stof(argv[7]);
     if (cfg.width < 640) cfg.width = 640;
     if (cfg.height < 480) cfg.height = 480;
     if (cfg.threads < 1) cfg.threads = 1;
     if (cfg.fps < 1) cfg.fps = 60;
+    if (cfg.turnover < 0.0f) cfg.turnover = 0.0f;
     return cfg;
 }
 
@@ -105,18 +101,15 @@ int main(int argc, char** argv) {
     std::uniform_real_distribution<float> ux(0.0f, (float)cfg.width);
     std::uniform_real_distribution<float> uy(0.0f, (float)cfg.height);
     std::uniform_real_distribution<float> uv(-120.0f, 120.0f);
-    std::uniform_int_distribution<int> ur(3, 20);
-    std::uniform_int_distribution<int> uc(0, 255);
-
-    // Crear partículas
-    std::vector<Particle> particles(cfg.N);
-    for (auto& p : particles) {
-        p.r = ur(rng);
-        p.x = ux(rng); p.y = uy(rng);
-        p.vx = uv(rng) * 0.01f; p.vy = uv(rng) * 0.01f;
-        p.ax = p.ay = 0.0f;
-        p.cr = uc(rng); p.cg = uc(rng); p.cb = uc(rng);
-        p.alpha = 160 + uc(rng) % 96;
+    std::uniform_real_distribution<float> ul(0.0f, 2.0f);
+
+    // Pool de partículas con capacidad fija (población base + margen para ráfagas)
+    ParticlePool<Particle> particles((size_t)cfg.N * 2 + BURST_SIZE * 8);
+    unsigned long born = 0;
+    for (int i = 0; i < cfg.N; i++) {
+        // Sin renovación las partículas iniciales son inmortales
+        float life = cfg.turnover > 0.0f ? ul(rng) / cfg.turnover : std::numeric_limits<float>::infinity();
+        initParticle(*particles.spawn(), ux(rng), uy(rng), uv(rng) * 0.01f, uv(rng) * 0.01f, life, rng, born++);
     }
 
     SDL_SetRenderDrawBlendMode(ren, SDL_BLENDMODE_BLEND);
@@ -134,6 +127,11 @@ int main(int argc, char** argv) {
     int mouseX = -1, mouseY = -1;
     bool mouseClick = false;
     double acc_update_time = 0.0;
+    double acc_spawn_time = 0.0;
+    double acc_kill_time = 0.0;
+    double emit_acc = 0.0;
+    long total_spawned = 0, total_killed = 0;
+    auto isDead = [](const Particle& p) { return p.life <= 0.0f; };
     int frame_counter = 0;
 
     // Bucle principal
@@ -158,8 +156,14 @@ int main(int argc, char** argv) {
         while (accumulator >= dt_fixed) {
             double update_s = now_seconds();
 
+            // Nacimientos: emisor continuo y ráfaga en el clic
+            double spawn_s = now_seconds();
+            total_spawned += emitParticles(particles, cfg.N, cfg.width, cfg.height, cfg.turnover, dt_fixed, emit_acc, mouseClick, mouseX, mouseY, rng, born);
+            acc_spawn_time += (now_seconds() - spawn_s);
+
             // Actualizar partículas en paralelo
-            #pragma omp parallel for schedule(dynamic)
+            int deaths = 0;
+            #pragma omp parallel for schedule(dynamic) reduction(+:deaths)
             for (size_t i = 0; i < particles.size(); i++) {
                 auto& p = particles[i];
                 float cx = cfg.width * 0.5f;
@@ -176,7 +180,7 @@ int main(int argc, char** argv) {
                     float dym = mouseY - p.y;
                     float distSq = dxm * dxm + dym * dym;
                     float maxDist = 100.0f;
-                    if (distSq < maxDist * maxDist) {
+                    if (distSq < maxDist * maxDist && distSq > 1e-10f) {
                         float factor = (1.0f - std::sqrt(distSq) / maxDist) * 0.5f;
                         float angle = std::atan2(dym, dxm);
                         float push = factor * 8.0f;
@@ -198,6 +202,17 @@ int main(int argc, char** argv) {
                 else if (p.x > cfg.width - p.r) { p.x = cfg.width - p.r; p.vx = -p.vx * 0.9f; }
                 if (p.y < p.r) { p.y = p.r; p.vy = -p.vy * 0.9f; }
                 else if (p.y > cfg.height - p.r) { p.y = cfg.height - p.r; p.vy = -p.vy * 0.9f; }
+
+                // Envejecimiento
+                p.life -= dt_fixed;
+                if (p.life <= 0.0f) deaths++;
+            }
+
+            // Muertes: compactación paralela solo si alguna partícula murió
+            if (deaths > 0) {
+                double kill_s = now_seconds();
+                total_killed += particles.compact(isDead);
+                acc_kill_time += (now_seconds() - kill_s);
             }
 
             acc_update_time += (now_seconds() - update_s);
@@ -219,7 +234,7 @@ int main(int argc, char** argv) {
             auto& p = particles[i];
             float t = SDL_GetTicks() / 1000.0f;
             float speed = 0.9f;
-            float hue = fmod(t * speed + i * 0.02f, 1.0f);
+            float hue = fmod(t * speed + p.hue, 1.0f);
             float r = std::abs(std::sin(hue * 2 * M_PI));
             float g = std::abs(std::sin((hue + 0.33f) * 2 * M_PI));
             float b = std::abs(std::sin((hue + 0.66f) * 2 * M_PI));
@@ -229,7 +244,7 @@ int main(int argc, char** argv) {
 
             SDL_Texture* tex = tex_by_r[p.r];
             SDL_SetTextureColorMod(tex, p.cr, p.cg, p.cb);
-            SDL_SetTextureAlphaMod(tex, p.alpha);
+            SDL_SetTextureAlphaMod(tex, Uint8(p.alpha * std::min(1.0f, p.life / p.fade)));
             SDL_Rect dst = { int(p.x - p.r), int(p.y - p.r), p.r * 2, p.r * 2 };
             SDL_RenderCopy(ren, tex, nullptr, &dst);
         }
@@ -243,6 +258,10 @@ int main(int argc, char** argv) {
     double elapsed = t_end - t_start;
     printf("TIME_TOTAL %f\n", elapsed);
     printf("TIME_UPDATE %f\n", acc_update_time);
+    printf("TIME_SPAWN %f\n", acc_spawn_time);
+    printf("TIME_KILL %f\n", acc_kill_time);
+    printf("SPAWNED %ld\n", total_spawned);
+    printf("KILLED %ld\n", total_killed);
 
     // Bucle final: fondo y partículas animadas hasta que el usuario cierre
     bool keepRunning = true;
@@ -267,8 +286,11 @@ int main(int argc, char** argv) {
         SDL_SetRenderDrawColor(ren, rbg, gbg, bbg, 40);
         SDL_RenderFillRect(ren, nullptr);
 
-        // Actualizar partículas (sin cronómetro ni rendimiento)
-        for (auto& p : particles) {
+        // Nacimientos y actualización de partículas (sin cronómetro ni rendimiento)
+        emitParticles(particles, cfg.N, cfg.width, cfg.height, cfg.turnover, dt_fixed, emit_acc, mouseClick, mouseX, mouseY, rng, born);
+        int deaths = 0;
+        for (size_t i = 0; i < particles.size(); i++) {
+            auto& p = particles[i];
             float cx = cfg.width * 0.5f;
             float cy = cfg.height * 0.5f;
             float dx = cx - p.x, dy = cy - p.y;
@@ -283,7 +305,7 @@ int main(int argc, char** argv) {
                 float dym = mouseY - p.y;
                 float distSq = dxm * dxm + dym * dym;
                 float maxDist = 100.0f;
-                if (distSq < maxDist * maxDist) {
+                if (distSq < maxDist * maxDist && distSq > 1e-10f) {
                     float factor = (1.0f - std::sqrt(distSq) / maxDist) * 0.5f;
                     float angle = std::atan2(dym, dxm);
                     float push = factor * 8.0f;
@@ -305,14 +327,18 @@ int main(int argc, char** argv) {
             else if (p.x > cfg.width - p.r) { p.x = cfg.width - p.r; p.vx = -p.vx * 0.9f; }
             if (p.y < p.r) { p.y = p.r; p.vy = -p.vy * 0.9f; }
             else if (p.y > cfg.height - p.r) { p.y = cfg.height - p.r; p.vy = -p.vy * 0.9f; }
+
+            p.life -= dt_fixed;
+            if (p.life <= 0.0f) deaths++;
         }
+        if (deaths > 0) particles.compact(isDead);
 
         // Render de partículas
         for (size_t i = 0; i < particles.size(); ++i) {
             auto& p = particles[i];
             float t = SDL_GetTicks() / 1000.0f;
             float speed = 0.9f;
-            float hue = fmod(t * speed + i * 0.02f, 1.0f);
+            float hue = fmod(t * speed + p.hue, 1.0f);
             float r = std::abs(std::sin(hue * 2 * M_PI));
             float g = std::abs(std::sin((hue + 0.33f) * 2 * M_PI));
             float b = std::abs(std::sin((hue + 0.66f) * 2 * M_PI));
@@ -322,7 +348,7 @@ int main(int argc, char** argv) {
 
             SDL_Texture* tex = tex_by_r[p.r];
             SDL_SetTextureColorMod(tex, p.cr, p.cg, p.cb);
-            SDL_SetTextureAlphaMod(tex, p.alpha);
+            SDL_SetTextureAlphaMod(tex, Uint8(p.alpha * std::min(1.0f, p.life / p.fade)));
             SDL_Rect dst = { int(p.x - p.r), int(p.y - p.r), p.r * 2, p.r * 2 };
             SDL_RenderCopy(ren, tex, nullptr, &dst);
         }
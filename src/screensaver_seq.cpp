@@ -1,6 +1,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include "timing_helpers.h"
+#include "particle.h"
 
 #include <SDL2/SDL.h>
 #include <vector>
@@ -10,16 +11,8 @@
 #include <iostream>
 #include <stdexcept>
 #include <unordered_map>
-
-// Estructura para representar una partícula
-struct Particle {
-    float x, y;           // Posición
-    float vx, vy;         // Velocidad
-    float ax, ay;         // Aceleración
-    int r;                // Radio
-    Uint8 cr, cg, cb;     // Color (RGB)
-    Uint8 alpha;          // Transparencia
-};
+#include <limits>
+#include <algorithm>
 
 // Estructura para la configuración del programa
 struct Config {
@@ -27,6 +20,7 @@ struct Config {
     int width = 800;      // Ancho de ventana
     int height = 600;     // Alto de ventana
     int frames = 500;     // Cantidad de frames que se simularán
+    float turnover = 0.0f; // Fracción de la población renovada por segundo
 };
 
 // Función que analiza argumentos de línea de comandos
@@ -36,8 +30,10 @@ static Config parseArgs(int argc, char** argv) {
     if (argc > 2) cfg.width = std::stoi(argv[2]);
     if (argc > 3) cfg.height = std::stoi(argv[3]);
     if (argc > 4) cfg.frames = std::stoi(argv[4]);
+    if (argc > 5) cfg.turnover = std::stof(argv[5]);
     if (cfg.width < 640) cfg.width = 640;
     if (cfg.height < 480) cfg.height = 480;
+    if (cfg.turnover < 0.0f) cfg.turnover = 0.0f;
     return cfg;
 }
 
@@ -88,20 +84,15 @@ int main(int argc, char** argv) {
     std::uniform_real_distribution<float> ux(0.0f,(float)cfg.width);
     std::uniform_real_distribution<float> uy(0.0f,(float)cfg.height);
     std::uniform_real_distribution<float> uv(-120.0f,120.0f);
-    std::uniform_int_distribution<int> ur(3,20);
-    std::uniform_int_distribution<int> uc(0,255);
+    std::uniform_real_distribution<float> ul(0.0f,2.0f);
 
-    // Creación de partículas
-    std::vector<Particle> particles;
+    // Creación de partículas en un pool de capacidad fija (población base + margen para ráfagas)
+    ParticlePool<Particle> particles((size_t)cfg.N*2 + BURST_SIZE*8);
+    unsigned long born = 0;
     for(int i=0;i<cfg.N;i++){
-        Particle p;
-        p.r = ur(rng);
-        p.x = ux(rng); p.y = uy(rng);
-        p.vx = uv(rng)*0.01f; p.vy = uv(rng)*0.01f;
-        p.ax = p.ay = 0.0f;
-        p.cr = uc(rng); p.cg = uc(rng); p.cb = uc(rng);
-        p.alpha = 160 + uc(rng)%96;
-        particles.push_back(p);
+        // Sin renovación las partículas iniciales son inmortales
+        float life = cfg.turnover > 0.0f ? ul(rng)/cfg.turnover : std::numeric_limits<float>::infinity();
+        initParticle(*particles.spawn(), ux(rng), uy(rng), uv(rng)*0.01f, uv(rng)*0.01f, life, rng, born++);
     }
 
     SDL_SetRenderDrawBlendMode(ren,SDL_BLENDMODE_BLEND);
@@ -124,6 +115,11 @@ int main(int argc, char** argv) {
     // Temporizador para medir el rendimiento
     double t_start = now_seconds();
     double acc_update_time = 0.0;
+    double acc_spawn_time = 0.0;
+    double acc_kill_time = 0.0;
+    double emit_acc = 0.0;
+    long total_spawned = 0, total_killed = 0;
+    auto isDead = [](const Particle& p){ return p.life <= 0.0f; };
     int frame_counter = 0;
 
     // Bucle principal
@@ -148,7 +144,14 @@ int main(int argc, char** argv) {
         while(accumulator>=dt_fixed){
             double update_s = now_seconds();
 
-            for(auto &p:particles){
+            // Nacimientos: emisor continuo y ráfaga en el clic
+            double spawn_s = now_seconds();
+            total_spawned += emitParticles(particles, cfg.N, cfg.width, cfg.height, cfg.turnover, dt_fixed, emit_acc, mouse_clicked, mouse_x, mouse_y, rng, born);
+            acc_spawn_time += (now_seconds() - spawn_s);
+
+            int deaths = 0;
+            for(size_t i=0;i<particles.size();i++){
+                auto &p = particles[i];
                 float cx = cfg.width*0.5f;
                 float cy = cfg.height*0.5f;
                 float dx = cx-p.x, dy = cy-p.y;
@@ -179,6 +182,17 @@ int main(int argc, char** argv) {
                 else if(p.x>cfg.width-p.r){p.x=cfg.width-p.r;p.vx=-p.vx*0.9f;}
                 if(p.y<p.r){p.y=p.r;p.vy=-p.vy*0.9f;}
                 else if(p.y>cfg.height-p.r){p.y=cfg.height-p.r;p.vy=-p.vy*0.9f;}
+
+                // Envejecimiento
+                p.life -= dt_fixed;
+                if(p.life<=0.0f) deaths++;
+            }
+
+            // Muertes: compactación solo si alguna partícula murió
+            if(deaths>0){
+                double kill_s = now_seconds();
+                total_killed += particles.compact(isDead);
+                acc_kill_time += (now_seconds() - kill_s);
             }
             mouse_clicked = false;
             accumulator-=dt_fixed;
@@ -204,7 +218,7 @@ int main(int argc, char** argv) {
 
         for(size_t i=0; i<particles.size(); i++){
             auto &p = particles[i];
-            float hue = std::fmod(time * 0.6f + i * 0.02f, 1.0f);
+            float hue = std::fmod(time * 0.6f + p.hue, 1.0f);
             float r = std::abs(std::sin(hue * 2 * M_PI));
             float g = std::abs(std::sin((hue + 0.33f) * 2 * M_PI));
             float b = std::abs(std::sin((hue + 0.66f) * 2 * M_PI));
@@ -214,7 +228,7 @@ int main(int argc, char** argv) {
 
             SDL_Texture* tex = tex_by_r[p.r];
             SDL_SetTextureColorMod(tex, p.cr, p.cg, p.cb);
-            SDL_SetTextureAlphaMod(tex, p.alpha);
+            SDL_SetTextureAlphaMod(tex, Uint8(p.alpha * std::min(1.0f, p.life / p.fade)));
             SDL_Rect dst = {int(p.x-p.r), int(p.y-p.r), p.r*2, p.r*2};
             SDL_RenderCopy(ren, tex, nullptr, &dst);
         }
@@ -228,6 +242,10 @@ int main(int argc, char** argv) {
     double elapsed = t_end - t_start;
     printf("TIME_TOTAL %f\n", elapsed);
     printf("TIME_UPDATE %f\n", acc_update_time);
+    printf("TIME_SPAWN %f\n", acc_spawn_time);
+    printf("TIME_KILL %f\n", acc_kill_time);
+    printf("SPAWNED %ld\n", total_spawned);
+    printf("KILLED %ld\n", total_killed);
 
         // Animación final hasta cerrar ventana
     bool keepRunning = true;
@@ -252,8 +270,11 @@ int main(int argc, char** argv) {
         SDL_SetRenderDrawColor(ren, rbg, gbg, bbg, 40);
         SDL_RenderFillRect(ren, &full);
 
-        // Actualizar partículas sin medir tiempo
-        for (auto& p : particles) {
+        // Nacimientos y actualización de partículas sin medir tiempo
+        emitParticles(particles, cfg.N, cfg.width, cfg.height, cfg.turnover, dt_fixed, emit_acc, mouse_clicked, mouse_x, mouse_y, rng, born);
+        int deaths = 0;
+        for (size_t i = 0; i < particles.size(); i++) {
+            auto& p = particles[i];
             float cx = cfg.width * 0.5f;
             float cy = cfg.height * 0.5f;
             float dx = cx - p.x, dy = cy - p.y;
@@ -286,13 +307,17 @@ int main(int argc, char** argv) {
             else if (p.x > cfg.width - p.r) { p.x = cfg.width - p.r; p.vx = -p.vx * 0.9f; }
             if (p.y < p.r) { p.y = p.r; p.vy = -p.vy * 0.9f; }
             else if (p.y > cfg.height - p.r) { p.y = cfg.height - p.r; p.vy = -p.vy * 0.9f; }
+
+            p.life -= dt_fixed;
+            if (p.life <= 0.0f) deaths++;
         }
+        if (deaths > 0) particles.compact(isDead);
 
         // Dibujar partículas con gradiente
         float time = SDL_GetTicks() / 1000.0f;
         for (size_t i = 0; i < particles.size(); i++) {
             auto& p = particles[i];
-            float hue = std::fmod(time * 0.6f + i * 0.02f, 1.0f);
+            float hue = std::fmod(time * 0.6f + p.hue, 1.0f);
             float r = std::abs(std::sin(hue * 2 * M_PI));
             float g = std::abs(std::sin((hue + 0.33f) * 2 * M_PI));
             float b = std::abs(std::sin((hue + 0.66f) * 2 * M_PI));
@@ -302,7 +327,7 @@ int main(int argc, char** argv) {
 
             SDL_Texture* tex = tex_by_r[p.r];
             SDL_SetTextureColorMod(tex, p.cr, p.cg, p.cb);
-            SDL_SetTextureAlphaMod(tex, p.alpha);
+            SDL_SetTextureAlphaMod(tex, Uint8(p.alpha * std::min(1.0f, p.life / p.fade)));
             SDL_Rect dst = { int(p.x - p.r), int(p.y - p.r), p.r * 2, p.r * 2 };
             SDL_RenderCopy(ren, tex, nullptr, &dst);
         }